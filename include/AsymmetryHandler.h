@@ -56,6 +56,9 @@ public:
 
     void reportAsymmetry(const std::string& region, int termIndex, const std::string& binPrefix) const;
 
+    /// true if any config has an asymmetryPW result for this region
+    bool hasRegion(const std::string& region) const;
+
     void collectSystematics(const std::string& region, int termIndex, const std::string& binPrefix) const;
     void dumpYaml(const std::string& outPath, bool append) const;
 
@@ -0,0 +1,49 @@
+#pragma once
+#include <map>
+#include <string>
+#include <vector>
+
+#include "Config.h"
+#include "MomentSidecar.h"
+#include "Result.h"
+
+/// Coarser or alternative binnings of bin_variable without re-reading
+/// events: neighbouring configs (ordered by their kinematicBins value)
+/// are merged by adding their moment sidecars and solving for the
+/// amplitudes (MomentSidecar::solve).
+class BinMerger {
+public:
+    BinMerger(const std::string& projectDir, const std::string& pionPair, const std::string& runVersion,
+              const std::map<std::string, std::map<std::string, Result>>& allResults, const std::map<std::string, Config>& configMap);
+
+    /// groups of n consecutive bins; the last group may be smaller
+    void mergeConsecutive(size_t n);
+
+    /// one group per [edges[k], edges[k+1]) of the bin value
+    void mergeByEdges(const std::vector<double>& edges);
+
+    void dumpYaml(const std::string& outPath, bool append) const;
+
+    /// configs without a readable moment sidecar (e.g. fitted with engine=roofit)
+    const std::vector<std::string>& missing() const {
+        return missing_;
+    }
+
+private:
+    struct Bin {
+        std::string cfgName;
+        double binVal;
+        MomentSidecar sidecar;
+    };
+    struct MergedBin {
+        std::vector<std::string> cfgNames;
+        double binVal; // signal-entries weighted mean of the merged bins
+        Result result;
+    };
+    void merge(const std::vector<std::vector<size_t>>& groups);
+
+    std::string pionPair_, runVersion_, binVar_;
+    std::vector<Bin> bins_; // ordered by binVal; configs without a sidecar are left out
+    std::vector<std::string> missing_;
+    std::vector<MergedBin> merged_;
+};
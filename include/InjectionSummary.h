@@ -0,0 +1,27 @@
+#pragma once
+#include <map>
+#include <string>
+
+#include "Config.h"
+#include "Result.h"
+
+/// One compact YAML of the injection-closure studies of a project
+/// (out/<project>/injection_summary.yaml), built from the
+/// asymmetryInjectionPW results of InjectionProcessor: per config the bin
+/// value and, per region and term, the injected value, the trial
+/// statistics and the list of trial values, so the plotting code no
+/// longer opens every asymmetryInjection_results_NNNN.yaml.
+class InjectionSummary {
+public:
+    InjectionSummary(const std::string& pionPair, const std::string& runVersion,
+                     const std::map<std::string, std::map<std::string, Result>>& allResults,
+                     const std::map<std::string, Config>& configMap);
+
+    /// false if no config has injection results (nothing written)
+    bool dumpYaml(const std::string& outPath, bool append) const;
+
+private:
+    std::string pionPair_, runVersion_;
+    std::map<std::string, std::map<std::string, Result>> allResults_;
+    std::map<std::string, Config> configMap_;
+};
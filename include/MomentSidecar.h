@@ -0,0 +1,52 @@
+#pragma once
+#include <map>
+#include <string>
+#include <vector>
+
+#include "Result.h"
+
+/// Sufficient statistics of one asymmetryPW output directory
+/// (asymmetry_moments.yaml, written by src/modules/asymmetry.C).
+///
+/// Per region the linear system the moments method (method=moments,
+/// fitMoments() in PartialWaveFit.C) solves: g = Σ n r·x_i and
+/// h = Σ n r²·x_i x_j, the gradient and Hessian of −log L at b = 0 with
+/// r = Pol·hel, or Pol·hel·p / (1 + Pol·hel·(1−p)·Σ bkg x) for purity
+/// mixtures with the bin's fitted background amplitudes.  Every entry is
+/// a sum over events, so the sidecars of adjacent kinematic bins add up
+/// to the sidecar of the merged bin, whose moment estimate is
+///
+///     b = h⁻¹ g,    cov = h⁻¹   (h⁻¹ h_w2 h⁻¹ for sWeighted regions)
+///
+/// which is what fitMoments() returns for a single bin.
+class MomentSidecar {
+public:
+    struct Region {
+        double entries = 0;
+        std::vector<double> g;   // P
+        std::vector<double> h;   // P×P, row-major
+        std::vector<double> hW2; // P×P with squared weights (sWeighted regions), else empty
+    };
+
+    /// false (and a warning) if the file is missing or malformed
+    bool load(const std::string& yamlPath);
+
+    /// add the sums of another bin; false if its regions or terms differ
+    bool add(const MomentSidecar& other);
+
+    /// moment-method amplitudes in the layout AsymmetryProcessor produces:
+    /// "<region>.entries", "<region>.b_i", "<region>.b_i_err"
+    Result solve() const;
+
+    bool empty() const {
+        return regions_.empty();
+    }
+
+    /// events of the first region that is not "background" (all signal
+    /// regions of a sidecar hold the same events)
+    double signalEntries() const;
+
+private:
+    std::vector<std::string> terms_;
+    std::map<std::string, Region> regions_;
+};
@@ -38,7 +38,7 @@ private:
     std::string projectDir_, pionPair_, runPeriod_;
     std::vector<Config> configs_;
     std::vector<std::string> moduleNames_ = {"asymmetryPW",   "binMigration",   "baryonContamination", "particleMisidentification",
-                                             "kinematicBins", "sidebandRegion", "normalization"};
+                                             "kinematicBins", "sidebandRegion", "normalization",       "asymmetryInjectionPW"};
     std::map<std::string, std::map<std::string, Result>> allResults_;
     std::map<std::string, Config> configs_map_;
 };
\ No newline at end of file
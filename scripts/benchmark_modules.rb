@@ -0,0 +1,56 @@
+#!/usr/bin/env ruby
+# coding: utf-8
+# ------------------------------------------------------------------
+#  Wall time of the compiled modules (build/yapwr-module) against the
+#  `root -l -b -q macro.C` JIT they replace.
+#
+#    scripts/benchmark_modules.rb [--repeat N]
+#        start-up + JIT cost alone: benchmarkKernels on a handful of events
+#    scripts/benchmark_modules.rb [--repeat N] MODULE PROJECT [CONFIG ...]
+#        a whole module over out/PROJECT, e.g.  asymmetry test config_x
+#        (MODULE is the suffix of scripts/modules/module___MODULE.rb)
+#
+#  Runs are local (no --slurm) and overwrite the module's outputs.
+# ------------------------------------------------------------------
+require 'optparse'
+require 'benchmark'
+require 'shellwords'
+
+MODULE_EXE = ENV.fetch('YAPWR_MODULE', File.join('build', 'yapwr-module'))
+
+repeat = 3
+OptionParser.new do |o|
+  o.banner = "Usage: #{$0} [--repeat N] [MODULE PROJECT [CONFIG ...]]"
+  o.on('--repeat N', Integer, 'Runs per path, best time is kept (default 3)') { |n| repeat = n if n.positive? }
+  o.on('-h', '--help') { puts o; exit }
+end.parse!
+
+abort "ERROR: #{MODULE_EXE} not found; build it with `cmake -S . -B build && cmake --build build`" unless File.executable?(MODULE_EXE)
+
+if ARGV.empty?
+  label = 'benchmarkKernels(1000, 1, 1)'
+  paths = {
+    'root JIT' => [{}, %q{root -l -b -q 'src/modules/benchmarkKernels.C(1000,1,1)'}],
+    'compiled' => [{}, "#{MODULE_EXE} benchmarkKernels 1000 1 1"]
+  }
+else
+  mod, *rest = ARGV
+  runner = File.join('scripts', 'modules', "module___#{mod}.rb")
+  abort "ERROR: no runner #{runner}" unless File.exist?(runner)
+  label = "#{mod} #{rest.join(' ')}"
+  cmd   = ['ruby', runner, *rest].shelljoin
+  paths = {
+    'root JIT' => [{ 'YAPWR_MODULE' => 'jit' }, cmd],
+    'compiled' => [{ 'YAPWR_MODULE' => MODULE_EXE }, cmd]
+  }
+end
+
+puts "[benchmark_modules] #{label}, best of #{repeat}"
+best = paths.transform_values do |(env, cmd)|
+  Array.new(repeat) do
+    Benchmark.realtime { system(env, cmd, out: File::NULL) or warn "[benchmark_modules] FAILED: #{cmd}" }
+  end.min
+end
+
+best.each { |name, t| puts format('  %-10s %9.2f s', name, t) }
+puts format('  speed-up   %9.2fx', best['root JIT'] / best['compiled'])
@@ -20,8 +20,14 @@ class AsymmetryPWRunner < ModuleRunner
     run_job(ctx[:tag], outdir, cmd)
   end
 
-  def macro_call(ctx)
-    %Q{'src/modules/asymmetry.C("#{ctx[:filtered_tfile]}","#{ctx[:tree_name]}","#{ctx[:pair]}","#{ctx[:outdir]}")'}
+  def macro_name
+    'asymmetry'
+  end
+
+  def macro_args(ctx)
+    args = [ctx[:filtered_tfile], ctx[:tree_name], ctx[:pair], ctx[:outdir]]
+    args << fit_options unless fit_options.empty?
+    args
   end
 
   def slurm_job_name(tag)
@@ -29,7 +35,7 @@ class AsymmetryPWRunner < ModuleRunner
   end
 
   def slurm_directives
-    { time: '24:00:00', mem_per_cpu: '4000', cpus: 1 }
+    { time: '24:00:00', mem_per_cpu: '1000', cpus: 4 }
   end
 end
 
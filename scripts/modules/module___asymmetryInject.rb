@@ -14,7 +14,7 @@ class AsymmetryInjectionPWRunner < ModuleRunner
 
   def module_key          ; 'asymmetryInjectionPW' end
   def slurm_job_name(t)   ; "inj_#{t}"              end
-  def slurm_directives    ; { time: '24:00:00', mem_per_cpu: '4000', cpus: 1 } end
+  def slurm_directives    ; { time: '24:00:00', mem_per_cpu: '1000', cpus: 4 } end
   def needs_filtered_file?; false                  end     # data-side filter not required
   def keep_leaf?(tag, _)  ; !tag.start_with?('MC_') end    # data only
 
@@ -36,6 +36,12 @@ class AsymmetryInjectionPWRunner < ModuleRunner
            'Number of SLURM jobs to submit (default 10)')      { |n| opts_hash[:jobs]    = n if n.positive? }
       o.on('--per-job M', '--trials-per-job M', Integer,
            'Number of trials *inside* each job (default 10)')  { |m| opts_hash[:per_job] = m if m.positive? }
+      o.on('--fit-options S', String,
+           'Comma-separated key=value fit options')            { |s| opts_hash[:fit_options] = s }
+      o.on('--asimov',
+           'One weighted fit of the expected dataset per leaf')  { opts_hash[:asimov] = true }
+      o.on('--seed S', Integer,
+           'Helicity RNG seed (default: random, printed)')      { |s| opts_hash[:seed] = s if s.positive? }
 
       o.on('-h', '--help', 'Show this help') { puts o; exit }
     end
@@ -48,6 +54,9 @@ class AsymmetryInjectionPWRunner < ModuleRunner
     opts_hash[:max_entries] ||= -1
     opts_hash[:jobs]       ||= 4
     opts_hash[:per_job]    ||= 4
+    # one seed for every job: the trials differ by their index
+    opts_hash[:seed]       ||= Random.new_seed % (2**62) + 1
+    puts "[#{module_key}] helicity seed #{opts_hash[:seed]}"
     [project, user_cfgs]
   end
 
@@ -100,32 +109,40 @@ class AsymmetryInjectionPWRunner < ModuleRunner
     FileUtils.mkdir_p(outdir)
 
     # -------------------------------------------------------------
-    # build trials
+    # one command per job: it reads the MC tree once and runs
+    # --per-job trials (first trial = job * per_job) in process;
+    # --asimov needs a single job and no trials
     # -------------------------------------------------------------
-    total_trials = options[:jobs] * options[:per_job]
-    cmds = (0...total_trials).map do |trial|
-      build_root_cmd(ctx.merge(
+    (0...(options[:asimov] ? 1 : options[:jobs])).each do |job|
+      cmd = build_root_cmd(ctx.merge(
         pair:               pair,
         outdir:             outdir,
         filtered_MC_tfile:  filtered_mc_tfile,
         dataAsymYamlFile:   data_asym_yaml,
-        trial:              trial
+        trial:              job * options[:per_job],
+        n_trials:           options[:per_job]
       ))
+      run_multi("#{run_version}_batch#{job}", outdir, [cmd])
     end
+  end
 
-    # slice into batches of --per-job trials and launch
-    cmds.each_slice(options[:per_job]).with_index do |cmd_batch, idx|
-      batch_tag = "#{run_version}_batch#{idx}"
-      run_multi(batch_tag, outdir, cmd_batch)
-    end
+  # ---------------------------------------------------------------
+  # fit options: --asimov travels as asimov=1
+  # ---------------------------------------------------------------
+  def fit_options
+    opts = super
+    return opts unless options[:asimov]
+    opts.empty? ? 'asimov=1' : "#{opts},asimov=1"
   end
 
   # ---------------------------------------------------------------
-  # ROOT macro call (extra integer trial argument)
+  # macro arguments (first trial, fit options, number of trials, seed)
   # ---------------------------------------------------------------
-  def macro_call(ctx)
-    %Q{'src/modules/injectAsymmetry.C("#{ctx[:filtered_MC_tfile]}",
-"#{ctx[:tree_name]}","#{ctx[:pair]}","#{ctx[:outdir]}","#{ctx[:dataAsymYamlFile]}",#{ctx[:trial]})'}
+  def macro_name; 'injectAsymmetry' end
+
+  def macro_args(ctx)
+    [ctx[:filtered_MC_tfile], ctx[:tree_name], ctx[:pair], ctx[:outdir], ctx[:dataAsymYamlFile], ctx[:trial],
+     fit_options, ctx[:n_trials], options[:seed]]
   end
 
   # ---------------------------------------------------------------
@@ -28,15 +28,14 @@ class AsymmetrySidebandRunner < ModuleRunner
     filtered = File.join(ctx[:leaf_dir], File.basename(ctx[:orig_tfile]))
     return unless File.exist?(filtered)
 
-    BACKGROUND_REGIONS.each do |bkg|
-      sanitized = sanitize(bkg)
-      outdir    = File.join(ctx[:leaf_dir], "module-out___#{module_key}_#{sanitized}")
-      FileUtils.mkdir_p(outdir)
-
-      cmd     = root_line(filtered, ctx[:tree_name], pair, outdir, SIGNAL_REGION, bkg)
-      job_tag = "#{tag}_#{sanitized}"
-      run_job(job_tag, outdir, cmd)
+    # One ROOT process per leaf: the data are loaded once and every
+    # background region is fitted against the same signal region.
+    outdirs = BACKGROUND_REGIONS.map do |bkg|
+      File.join(ctx[:leaf_dir], "module-out___#{module_key}_#{sanitize(bkg)}").tap { |d| FileUtils.mkdir_p(d) }
     end
+
+    cmd = root_line(filtered, ctx[:tree_name], pair, outdirs.join(';'), SIGNAL_REGION, BACKGROUND_REGIONS.join(';'))
+    run_job(tag, ctx[:leaf_dir], cmd)
   end
 
   def slurm_job_name(tag)
@@ -44,13 +43,15 @@ class AsymmetrySidebandRunner < ModuleRunner
   end
 
   def slurm_directives
-    { time: '24:00:00', mem_per_cpu: '4000', cpus: 1 }
+    { time: '24:00:00', mem_per_cpu: '1000', cpus: 4 }
   end
 
   private
 
   def root_line(filtered, ttree, pair, outdir, sig, bkg)
-    %Q{root -l -b -q 'src/modules/asymmetry.C("#{filtered}","#{ttree}","#{pair}","#{outdir}","#{sig}","#{bkg}")'}
+    args = [filtered, ttree, pair, outdir, sig, bkg]
+    args << fit_options unless fit_options.empty?
+    module_cmd('asymmetry', args)
   end
 
   def sanitize(expr)
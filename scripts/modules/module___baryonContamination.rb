@@ -13,10 +13,6 @@ class BaryonContaminationRunner < ModuleRunner
     'baryonContamination.yaml'
   end
 
-  def macro_call(ctx)
-    %Q{'src/modules/baryonContamination.C("#{ctx[:orig_tfile]}","#{ctx[:tree_name]}","#{ctx[:primary_yaml]}","#{ctx[:out_yaml]}")'}
-  end
-
   def slurm_job_name(tag)
     "baryonCont_#{tag}"
   end
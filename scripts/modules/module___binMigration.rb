@@ -28,8 +28,8 @@ class BinMigrationRunner < ModuleRunner
     run_job(ctx[:tag], outdir, cmd)
   end
 
-  def macro_call(ctx)
-    %Q{'src/modules/binMigration.C("#{ctx[:orig_tfile]}","#{ctx[:tree_name]}","#{ctx[:primary_yaml]}","#{out_root}","#{ctx[:log_file]}")'}
+  def macro_args(ctx)
+    [ctx[:orig_tfile], ctx[:tree_name], ctx[:primary_yaml], out_root, ctx[:log_file]]
   end
 
   def slurm_job_name(tag)
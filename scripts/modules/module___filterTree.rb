@@ -27,8 +27,8 @@ class FilterTreeRunner < ModuleRunner
 
     # Build the (one or two) ROOT commands
     cmds = []
-    cmds << root_line('filterTree.C',   ctx[:orig_tfile], ctx[:tree_name], ctx[:primary_yaml], pair, outdir, max_ent)
-    cmds << root_line('filterTreeMC.C', ctx[:orig_tfile], ctx[:tree_name], ctx[:primary_yaml], pair, outdir, max_ent) if tag.start_with?('MC')
+    cmds << root_line('filterTree',   ctx[:orig_tfile], ctx[:tree_name], ctx[:primary_yaml], pair, outdir, max_ent)
+    cmds << root_line('filterTreeMC', ctx[:orig_tfile], ctx[:tree_name], ctx[:primary_yaml], pair, outdir, max_ent) if tag.start_with?('MC')
 
     # For Slurm: one script that runs both lines. For local: run sequentially.
     run_multi(tag, outdir, cmds)
@@ -49,7 +49,7 @@ class FilterTreeRunner < ModuleRunner
   private
 
   def root_line(macro, tfile, ttree, yaml_cfg, pair, outdir, max_entries)
-    %Q{root -l -q 'src/modules/#{macro}("#{tfile}","#{ttree}","#{yaml_cfg}","#{pair}","#{outdir}",#{max_entries})'}
+    module_cmd(macro, [tfile, ttree, yaml_cfg, pair, outdir, max_entries])
   end
 
   # Reuse base run_job machinery but allow multiple commands
@@ -24,8 +24,8 @@ class KinematicBinsRunner < ModuleRunner
     run_job(ctx[:tag], outdir, cmd)
   end
 
-  def macro_call(ctx)
-    %Q{'src/modules/kinematicBins.C("#{ctx[:orig_tfile]}","#{ctx[:tree_name]}","#{ctx[:pair]}","#{ctx[:primary_yaml]}","#{ctx[:outdir]}")'}
+  def macro_args(ctx)
+    [ctx[:orig_tfile], ctx[:tree_name], ctx[:pair], ctx[:primary_yaml], ctx[:outdir]]
   end
 
   def slurm_job_name(tag)
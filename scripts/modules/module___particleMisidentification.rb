@@ -13,10 +13,6 @@ class ParticleMisIDRunner < ModuleRunner
     'particleMisidentification.yaml'
   end
 
-  def macro_call(ctx)
-    %Q{'src/modules/particleMisidentification.C("#{ctx[:orig_tfile]}","#{ctx[:tree_name]}","#{ctx[:primary_yaml]}","#{ctx[:out_yaml]}")'}
-  end
-
   def slurm_job_name(tag)
     "pmisid_#{tag}"
   end
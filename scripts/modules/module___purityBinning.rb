@@ -31,9 +31,20 @@ class PurityBinningRunner < ModuleRunner
   end
 
   # ROOT macro signature:
-  # purityBinning.C(filtered_file, ttree, pair, output_dir)
-  def macro_call(ctx)
-    %Q{'src/modules/purityBinning.C("#{ctx[:filtered_tfile]}","#{ctx[:tree_name]}","#{ctx[:pair]}","#{ctx[:outdir]}")'}
+  # purityBinning.C(filtered_file, ttree, pair, output_dir, n_threads, method, grid_yaml)
+  # The cells are fitted on one thread per allocated CPU.
+  def macro_args(ctx)
+    [ctx[:filtered_tfile], ctx[:tree_name], ctx[:pair], ctx[:outdir], slurm_directives[:cpus], leaf_method(ctx[:tag]),
+     options[:grids].to_s]
+  end
+
+  # Injection draws its purities from the MC grids and has no sWeight path, so
+  # MC leaves always get grids; only data leaves are sWeighted under --method splot.
+  def leaf_method(tag)
+    return options[:method] unless options[:method] == 'splot' && tag.start_with?('MC_')
+
+    warn "[#{module_key}][#{tag}] MC leaf: building cell grids for injection instead of sWeights"
+    'cells'
   end
 
   def slurm_job_name(tag)
@@ -41,7 +52,36 @@ class PurityBinningRunner < ModuleRunner
   end
 
   def slurm_directives
-    { time: '24:00:00', mem_per_cpu: '2000', cpus: 1 }
+    { time: '24:00:00', mem_per_cpu: '1000', cpus: 4 }
+  end
+
+  # ---------------------------------------------------------------
+  # CLI parsing – adds --method
+  # ---------------------------------------------------------------
+  private def parse_cli(opts_hash)
+    opts = OptionParser.new do |o|
+      o.banner = "Usage: #{$0} [options] PROJECT_NAME [CONFIG ...]"
+
+      o.on('--slurm', 'Submit via sbatch')               { opts_hash[:slurm] = true }
+      o.on('--dependency D', String,
+           'Pass "afterok:IDs" to sbatch --dependency') { |d| opts_hash[:deps] = d }
+      o.on('--method M', %w[cells joint splot],
+           'cells: one fit per cell (default); joint: one fit per grid; ' \
+           'splot: one M2 fit, sWeights instead of grids (data only; MC keeps cells)')              { |m| opts_hash[:method] = m }
+      o.on('--grids FILE', String,
+           'YAML of extra grids to scan (purity_scan_<pair>.yaml)')    { |f| opts_hash[:grids] = File.expand_path(f) }
+
+      o.on('-h', '--help', 'Show this help') { puts o; exit }
+    end
+
+    opts.parse!(ARGV)
+
+    project   = ARGV.shift or abort opts.banner
+    user_cfgs = ARGV.map { |c| "config_#{File.basename(c, File.extname(c))}" }
+
+    opts_hash[:max_entries] ||= -1
+    opts_hash[:method]      ||= 'cells'
+    [project, user_cfgs]
   end
 end
 
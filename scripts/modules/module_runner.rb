@@ -1,8 +1,14 @@
 require 'yaml'
 require 'fileutils'
 require 'optparse'
+require 'shellwords'
 
 class ModuleRunner
+  # Modules compiled by CMake (`cmake --build build`) replace the per-leaf
+  # `root -l -b -q macro.C` JIT when the driver exists.  YAPWR_MODULE points
+  # at another build; YAPWR_MODULE=jit forces the ROOT macros.
+  MODULE_EXE = ENV.fetch('YAPWR_MODULE', File.join('build', 'yapwr-module'))
+
   attr_reader :options, :project, :user_configs, :out_root
 
   def self.run!
@@ -98,10 +104,16 @@ class ModuleRunner
     true
   end
 
+  # src/modules/<macro_name>.C / `yapwr-module <macro_name>`
+  def macro_name
+    module_key
+  end
+
+  # macro arguments in call order (Integers stay unquoted for ROOT);
   # ctx will include everything in process_leaf
-  def macro_call(ctx)
+  def macro_args(ctx)
     # default assumes 4-arg macro
-    %Q{'src/modules/#{module_key}.C("#{ctx[:orig_tfile]}","#{ctx[:tree_name]}","#{ctx[:primary_yaml]}","#{ctx[:out_yaml]}")'}
+    [ctx[:orig_tfile], ctx[:tree_name], ctx[:primary_yaml], ctx[:out_yaml]]
   end
 
   def slurm_job_name(tag)
@@ -112,6 +124,18 @@ class ModuleRunner
     { time: '24:00:00', mem_per_cpu: '1000', cpus: 1 }
   end
 
+  # --fit-options plus threads=<cpus> so the likelihood uses every core
+  # the job reserves (an explicit threads= from the user wins)
+  def fit_options
+    opts = options[:fit_options].to_s.split(',')
+    cpus = slurm_directives[:cpus].to_i
+    opts << "threads=#{cpus}" if cpus > 1 && opts.none? { |o| o.start_with?('threads=') }
+    # event-store cache: half the job's memory, the rest is ROOT, RooFit and the I/O buffers
+    mem = slurm_directives[:mem_per_cpu].to_i * [cpus, 1].max / 2
+    opts << "mem=#{mem}" if mem.positive? && opts.none? { |o| o.start_with?('mem=') }
+    opts.join(',')
+  end
+
   # ------------------------------------------------------------------
   # Internal (don’t override unless you know why)
   # ------------------------------------------------------------------
@@ -132,6 +156,10 @@ class ModuleRunner
         o.on('--maxEntries N', '--maxEntries=N', Integer, 'Limit max entries (positive)') do |n|
           opts_hash[:max_entries] = n if n.positive?
         end
+
+        o.on('--fit-options S', String, 'Comma-separated key=value fit options (e.g. engine=roofit)') do |s|
+          opts_hash[:fit_options] = s
+        end
     
         o.on('-h', '--help', 'Show this help') do
           puts o
@@ -159,7 +187,20 @@ class ModuleRunner
   end
 
   def build_root_cmd(ctx)
-    ['root', '-l', '-b', '-q', macro_call(ctx)].join(' ')
+    module_cmd(macro_name, macro_args(ctx))
+  end
+
+  def module_cmd(macro, args)
+    if compiled_modules?
+      [MODULE_EXE, macro, *args.map { |a| Shellwords.escape(a.to_s) }].join(' ')
+    else
+      list = args.map { |a| a.is_a?(Integer) ? a.to_s : %Q{"#{a}"} }.join(',')
+      ['root', '-l', '-b', '-q', %Q{'src/modules/#{macro}.C(#{list})'}].join(' ')
+    end
+  end
+
+  def compiled_modules?
+    File.file?(MODULE_EXE) && File.executable?(MODULE_EXE)
   end
 
   def run_job(tag, outdir, cmd)
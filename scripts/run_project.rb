@@ -26,11 +26,17 @@ parser = OptionParser.new do |opts|
        --maxEntries N     pass N to filterTree as entry limit
        --maxFiles   M     only create M tree_info.yaml per config
        --slurm            submit one Slurm job per CONFIG instead of running now
+       --fitOptions S     key=value list forwarded to the asymmetry fits (e.g. engine=roofit)
+       --purityMethod M   purityBinning fits: cells (default), joint or splot (sWeights, no grids)
+       --purityGrids F    YAML of extra purity grids to scan
   TXT
 
   opts.on('--append')               { options[:append] = true ; optlist << '--append' }
   opts.on('--maxEntries N', Integer){ |n| options[:maxEntries] = n ; optlist += ['--maxEntries', n.to_s] }
   opts.on('--maxFiles M',  Integer){ |m| options[:maxFiles]   = m ; optlist += ['--maxFiles',   m.to_s] }
+  opts.on('--fitOptions S', String){ |s| options[:fitOptions] = s ; optlist += ['--fitOptions', s] }
+  opts.on('--purityMethod M', String){ |m| options[:purityMethod] = m ; optlist += ['--purityMethod', m] }
+  opts.on('--purityGrids F',  String){ |f| options[:purityGrids]  = f ; optlist += ['--purityGrids', f] }
   opts.on('--slurm')                { options[:slurm]  = true }
   opts.on('--is_running_on_slurm')                { options[:is_running_on_slurm]  = true }
   opts.on('--doAll', 'Ignore the tag‐filters and use every merged file') do
@@ -245,6 +251,8 @@ modules.each do |mod|
     args = ['ruby', './scripts/modules/module___purityBinning.rb']
 
     args << '--slurm' if options[:is_running_on_slurm]
+    args += ['--method', options[:purityMethod]] if options[:purityMethod]
+    args += ['--grids', options[:purityGrids]] if options[:purityGrids]
     args << project_name
     args += config_files if config_files.any?
     if options[:is_running_on_slurm]
@@ -265,6 +273,7 @@ modules.each do |mod|
     if options[:is_running_on_slurm] && purity_ids.any?
       args << '--dependency' << "afterok:#{purity_ids.join(',')}"
     end
+    args += ['--fit-options', options[:fitOptions]] if options[:fitOptions]
     args << project_name
     args += config_files if config_files.any?
     invoke('asymmetry', *args)
@@ -275,6 +284,7 @@ modules.each do |mod|
     if options[:is_running_on_slurm] && purity_ids.any?
       args << '--dependency' << "afterok:#{purity_ids.join(',')}"
     end
+    args += ['--fit-options', options[:fitOptions]] if options[:fitOptions]
     args << project_name
     args += config_files if config_files.any?
     invoke('asymmetry_sideband', *args)
@@ -286,6 +296,7 @@ modules.each do |mod|
     if options[:is_running_on_slurm] && purity_ids.any?
       args << '--dependency' << "afterok:#{purity_ids.join(',')}"
     end
+    args += ['--fit-options', options[:fitOptions]] if options[:fitOptions]
     args << project_name
     args += config_files if config_files.any?
     invoke('asymmetryInject', *args)
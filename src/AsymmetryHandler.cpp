@@ -129,6 +129,15 @@ std::pair<std::string, double> AsymmetryHandler::getBinInfo(const std::string& c
     return std::make_pair(binField, binVal);
 }
 
+bool AsymmetryHandler::hasRegion(const std::string& region) const {
+    for (const auto& [cfgName, modules] : allResults_) {
+        auto aIt = modules.find(asymProc_.name());
+        if (aIt != modules.end() && aIt->second.scalars.count(region + ".entries"))
+            return true;
+    }
+    return false;
+}
+
 void AsymmetryHandler::reportAsymmetry(const std::string& region, int termIndex, const std::string& binPrefix) const {
 
     // First initialize the Asymmetry map, logging all asymmetry values/statistical errors
@@ -0,0 +1,135 @@
+#include "BinMerger.h"
+#include "KinematicBinsProcessor.h"
+#include "Logger.h"
+
+#include <algorithm>
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <yaml-cpp/yaml.h>
+
+namespace fs = std::filesystem;
+
+BinMerger::BinMerger(const std::string& projectDir, const std::string& pionPair, const std::string& runVersion,
+                     const std::map<std::string, std::map<std::string, Result>>& allResults,
+                     const std::map<std::string, Config>& configMap)
+    : pionPair_(pionPair)
+    , runVersion_(runVersion) {
+    for (const auto& [cfgName, modules] : allResults) {
+        const Config& cfg = configMap.at(cfgName);
+        binVar_ = cfg.getBinVariable();
+
+        double binVal = std::numeric_limits<double>::quiet_NaN();
+        if (auto kIt = modules.find("kinematicBins"); kIt != modules.end())
+            binVal = KinematicBinsProcessor::getBinScalar(kIt->second, "full", binVar_);
+        if (std::isnan(binVal)) {
+            LOG_WARN("BinMerger: no kinematicBins value for config " << cfgName << ", skipping");
+            continue;
+        }
+
+        // same layout as Synthesizer::runAll()
+        const fs::path sidecar =
+            "out" / fs::path(projectDir) / cfgName / pionPair / runVersion / "module-out___asymmetryPW" / "asymmetry_moments.yaml";
+        Bin bin{cfgName, binVal, {}};
+        if (!bin.sidecar.load(sidecar.string())) {
+            LOG_ERROR("BinMerger: no moment sidecar for config " << cfgName << " (" << sidecar.string() << ")");
+            missing_.push_back(cfgName);
+            continue;
+        }
+        bins_.push_back(std::move(bin));
+    }
+    std::sort(bins_.begin(), bins_.end(), [](const Bin& a, const Bin& b) {
+        return a.binVal < b.binVal;
+    });
+}
+
+void BinMerger::mergeConsecutive(size_t n) {
+    std::vector<std::vector<size_t>> groups;
+    for (size_t i = 0; i < bins_.size(); ++i) {
+        if (i % std::max<size_t>(n, 1) == 0)
+            groups.emplace_back();
+        groups.back().push_back(i);
+    }
+    merge(groups);
+}
+
+void BinMerger::mergeByEdges(const std::vector<double>& edges) {
+    std::vector<std::vector<size_t>> groups(edges.size() > 1 ? edges.size() - 1 : 0);
+    for (size_t i = 0; i < bins_.size(); ++i) {
+        const auto up = std::upper_bound(edges.begin(), edges.end(), bins_[i].binVal);
+        if (up == edges.begin() || up == edges.end()) {
+            LOG_WARN("BinMerger: " << bins_[i].cfgName << " (" << binVar_ << " = " << bins_[i].binVal << ") outside the edges");
+            continue;
+        }
+        groups[up - edges.begin() - 1].push_back(i);
+    }
+    merge(groups);
+}
+
+void BinMerger::merge(const std::vector<std::vector<size_t>>& groups) {
+    merged_.clear();
+    for (const auto& group : groups) {
+        if (group.empty())
+            continue;
+        MergedBin m;
+        MomentSidecar sum;
+        double w = 0.0, wx = 0.0;
+        for (size_t i : group) {
+            const Bin& b = bins_[i];
+            if (!sum.add(b.sidecar)) {
+                LOG_WARN("BinMerger: cannot merge " << b.cfgName << ", skipping it");
+                continue;
+            }
+            m.cfgNames.push_back(b.cfgName);
+            w += b.sidecar.signalEntries();
+            wx += b.sidecar.signalEntries() * b.binVal;
+        }
+        m.binVal = w > 0 ? wx / w : std::numeric_limits<double>::quiet_NaN();
+        m.result = sum.solve();
+        LOG_INFO("BinMerger: merged " << m.cfgNames.size() << " bins at " << binVar_ << " = " << m.binVal);
+        merged_.push_back(std::move(m));
+    }
+}
+
+void BinMerger::dumpYaml(const std::string& outPath, bool append) const {
+    YAML::Emitter out;
+    if (append)
+        out << YAML::BeginDoc;
+    out << YAML::BeginSeq;
+    for (const auto& m : merged_) {
+        out << YAML::BeginMap;
+        out << YAML::Key << "pionPair" << YAML::Value << pionPair_;
+        out << YAML::Key << "runVersion" << YAML::Value << runVersion_;
+        out << YAML::Key << "method" << YAML::Value << "moments";
+        out << YAML::Key << "configs" << YAML::Value << YAML::Flow << m.cfgNames;
+        out << YAML::Key << binVar_ << YAML::Value << m.binVal;
+        out << YAML::Key << "results" << YAML::Value << YAML::BeginMap;
+        // "<region>.<key>" scalars → one map per region
+        std::string region;
+        for (const auto& [key, val] : m.result.scalars) {
+            const std::string reg = key.substr(0, key.find('.'));
+            if (reg != region) {
+                if (!region.empty())
+                    out << YAML::EndMap;
+                region = reg;
+                out << YAML::Key << region << YAML::Value << YAML::BeginMap;
+            }
+            out << YAML::Key << key.substr(key.find('.') + 1) << YAML::Value << val;
+        }
+        if (!region.empty())
+            out << YAML::EndMap;
+        out << YAML::EndMap  // results
+            << YAML::EndMap; // this merged bin
+    }
+    out << YAML::EndSeq;
+
+    std::ofstream fout(outPath, append ? std::ios::app : std::ios::trunc);
+    if (!fout) {
+        LOG_ERROR("Unable to open " << outPath << " for writing");
+    } else {
+        if (append)
+            fout << '\n';
+        fout << out.c_str();
+    }
+}
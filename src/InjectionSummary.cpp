@@ -0,0 +1,104 @@
+#include "InjectionSummary.h"
+#include "KinematicBinsProcessor.h"
+#include "Logger.h"
+
+#include <cmath>
+#include <fstream>
+#include <limits>
+#include <set>
+#include <vector>
+#include <yaml-cpp/yaml.h>
+
+InjectionSummary::InjectionSummary(const std::string& pionPair, const std::string& runVersion,
+                                   const std::map<std::string, std::map<std::string, Result>>& allResults,
+                                   const std::map<std::string, Config>& configMap)
+    : pionPair_(pionPair)
+    , runVersion_(runVersion)
+    , allResults_(allResults)
+    , configMap_(configMap) {}
+
+bool InjectionSummary::dumpYaml(const std::string& outPath, bool append) const {
+    YAML::Emitter out;
+    out.SetDoublePrecision(8); // well below the trial spread, keeps the file small
+    if (append)
+        out << YAML::BeginDoc;
+    out << YAML::BeginSeq;
+    size_t nConfigs = 0;
+    for (const auto& [cfgName, modules] : allResults_) {
+        auto injIt = modules.find("asymmetryInjectionPW");
+        if (injIt == modules.end() || injIt->second.scalars.empty())
+            continue;
+        const std::string binVar = configMap_.at(cfgName).getBinVariable();
+        double binVal = std::numeric_limits<double>::quiet_NaN();
+        if (auto kIt = modules.find("kinematicBins"); kIt != modules.end())
+            binVal = KinematicBinsProcessor::getBinScalar(kIt->second, "full", binVar);
+
+        // "<region>.trials", "<region>.trial_NNNN.b_i", "<region>.b_i_<stat>"
+        struct Term {
+            std::map<std::string, double> stats;
+            std::map<int, double> values; // trial → b_i
+        };
+        struct Region {
+            std::set<int> trials;
+            std::map<int, Term> terms; // by term index
+        };
+        std::map<std::string, Region> regions;
+        for (const auto& [key, val] : injIt->second.scalars) {
+            const auto dot = key.find('.');
+            Region& reg = regions[key.substr(0, dot)];
+            const std::string rest = key.substr(dot + 1);
+            if (rest.rfind("trial_", 0) == 0) {
+                const auto dot2 = rest.find('.');
+                const int trial = std::stoi(rest.substr(6, dot2 - 6));
+                reg.trials.insert(trial);
+                reg.terms[std::stoi(rest.substr(dot2 + 3))].values[trial] = val;
+            } else if (rest.rfind("b_", 0) == 0) {
+                const auto us = rest.find('_', 2);
+                reg.terms[std::stoi(rest.substr(2, us - 2))].stats[rest.substr(us + 1)] = val;
+            }
+        }
+
+        out << YAML::BeginMap;
+        out << YAML::Key << "pionPair" << YAML::Value << pionPair_;
+        out << YAML::Key << "runVersion" << YAML::Value << runVersion_;
+        out << YAML::Key << "config" << YAML::Value << cfgName;
+        out << YAML::Key << binVar << YAML::Value << binVal;
+        out << YAML::Key << "regions" << YAML::Value << YAML::BeginMap;
+        for (const auto& [region, reg] : regions) {
+            const std::vector<int> trials(reg.trials.begin(), reg.trials.end());
+            out << YAML::Key << region << YAML::Value << YAML::BeginMap;
+            out << YAML::Key << "trials" << YAML::Value << YAML::Flow << trials;
+            for (const auto& [i, term] : reg.terms) {
+                out << YAML::Key << "b_" + std::to_string(i) << YAML::Value << YAML::BeginMap;
+                for (const auto& [stat, val] : term.stats)
+                    out << YAML::Key << stat << YAML::Value << val;
+                // one value per entry of `trials`, NaN where that trial has no b_i
+                std::vector<double> values;
+                for (int t : trials) {
+                    auto it = term.values.find(t);
+                    values.push_back(it == term.values.end() ? std::numeric_limits<double>::quiet_NaN() : it->second);
+                }
+                out << YAML::Key << "values" << YAML::Value << YAML::Flow << values;
+                out << YAML::EndMap;
+            }
+            out << YAML::EndMap;
+        }
+        out << YAML::EndMap  // regions
+            << YAML::EndMap; // this config
+        ++nConfigs;
+    }
+    out << YAML::EndSeq;
+    if (nConfigs == 0)
+        return false;
+
+    std::ofstream fout(outPath, append ? std::ios::app : std::ios::trunc);
+    if (!fout) {
+        LOG_ERROR("Unable to open " << outPath << " for writing");
+        return false;
+    }
+    if (append)
+        fout << '\n';
+    fout << out.c_str();
+    LOG_INFO("InjectionSummary: " << nConfigs << " configs written to " << outPath);
+    return true;
+}
@@ -0,0 +1,117 @@
+#include "MomentSidecar.h"
+#include "Logger.h"
+
+#include <TDecompChol.h>
+#include <TMatrixDSym.h>
+#include <TVectorD.h>
+#include <cmath>
+#include <yaml-cpp/yaml.h>
+
+bool MomentSidecar::load(const std::string& yamlPath) {
+    terms_.clear();
+    regions_.clear();
+    try {
+        YAML::Node doc = YAML::LoadFile(yamlPath);
+        terms_ = doc["terms"].as<std::vector<std::string>>();
+        const size_t P = terms_.size();
+        for (const auto& node : doc["regions"]) {
+            Region r;
+            r.entries = node["entries"].as<double>();
+            r.g = node["g"].as<std::vector<double>>();
+            for (auto [key, mat] : {std::make_pair("h", &r.h), std::make_pair("h_w2", &r.hW2)})
+                for (const auto& row : node[key]) {
+                    const auto v = row.as<std::vector<double>>();
+                    mat->insert(mat->end(), v.begin(), v.end());
+                }
+            if (r.g.size() != P || r.h.size() != P * P || (!r.hW2.empty() && r.hW2.size() != P * P)) {
+                LOG_WARN("Malformed region '" << node["region"].as<std::string>() << "' in " << yamlPath);
+                regions_.clear();
+                return false;
+            }
+            regions_[node["region"].as<std::string>()] = std::move(r);
+        }
+    } catch (const YAML::Exception& e) {
+        LOG_WARN("Cannot read moment sidecar '" << yamlPath << "': " << e.what());
+        regions_.clear();
+        return false;
+    }
+    return !regions_.empty();
+}
+
+bool MomentSidecar::add(const MomentSidecar& other) {
+    if (empty()) {
+        *this = other;
+        return true;
+    }
+    if (other.terms_ != terms_ || other.regions_.size() != regions_.size()) {
+        LOG_WARN("MomentSidecar::add(): sidecars with different terms or regions");
+        return false;
+    }
+    for (auto& [name, r] : regions_) {
+        auto it = other.regions_.find(name);
+        if (it == other.regions_.end()) {
+            LOG_WARN("MomentSidecar::add(): region " << name << " missing");
+            return false;
+        }
+        const Region& o = it->second;
+        if (o.hW2.empty() != r.hW2.empty()) {
+            LOG_WARN("MomentSidecar::add(): region " << name << " is sWeighted in one bin only");
+            return false;
+        }
+        r.entries += o.entries;
+        for (size_t i = 0; i < r.g.size(); ++i)
+            r.g[i] += o.g[i];
+        for (size_t i = 0; i < r.h.size(); ++i)
+            r.h[i] += o.h[i];
+        for (size_t i = 0; i < r.hW2.size(); ++i)
+            r.hW2[i] += o.hW2[i];
+    }
+    return true;
+}
+
+double MomentSidecar::signalEntries() const {
+    for (const auto& [name, r] : regions_)
+        if (name != "background")
+            return r.entries;
+    return 0.0;
+}
+
+Result MomentSidecar::solve() const {
+    Result res;
+    res.moduleName = "asymmetryPW";
+    const int P = terms_.size();
+
+    // b = h⁻¹ g,  cov = h⁻¹  (h⁻¹ h_w2 h⁻¹ with sWeights), as fitMoments()
+    for (const auto& [name, r] : regions_) {
+        res.scalars[name + ".entries"] = r.entries;
+        TMatrixDSym A(P);
+        TVectorD y(P);
+        for (int i = 0; i < P; ++i) {
+            y(i) = r.g[i];
+            for (int j = 0; j < P; ++j)
+                A(i, j) = r.h[i * P + j];
+        }
+        TDecompChol chol(A);
+        TMatrixDSym inv(P);
+        Bool_t ok = chol.Decompose();
+        TVectorD b = ok ? chol.Solve(y, ok) : y;
+        if (ok)
+            ok = chol.Invert(inv);
+        if (!ok) {
+            LOG_WARN("Singular moment matrix for region " << name);
+            continue;
+        }
+        for (int i = 0; i < P; ++i) {
+            double var = inv(i, i);
+            if (!r.hW2.empty()) {
+                var = 0.0;
+                for (int k = 0; k < P; ++k)
+                    for (int l = 0; l < P; ++l)
+                        var += inv(i, k) * r.hW2[k * P + l] * inv(l, i);
+            }
+            res.scalars[name + "." + terms_[i]] = b(i);
+            res.scalars[name + "." + terms_[i] + "_err"] = std::sqrt(var);
+        }
+    }
+    return res;
+}
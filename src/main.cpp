@@ -1,6 +1,9 @@
 #include "AsymmetryHandler.h"
+#include "BinMerger.h"
+#include "InjectionSummary.h"
 #include "Logger.h"
 #include "Synthesizer.h"
+#include "Utility.h"
 
 #include <iostream>
 #include <string>
@@ -9,8 +12,28 @@
 int main(int argc, char** argv) {
     Logger::setLevel(Logger::Level::Error);
 
-    if (argc != 2) {
-        std::cerr << "Usage: " << argv[0] << " <projectDir>\n";
+    // optional re-binning from the moment sidecars:
+    //   --merge N              N consecutive bins at a time
+    //   --merge-edges a,b,c    bins with bin_variable in [a,b), [b,c)
+    size_t mergeN = 0;
+    std::vector<double> mergeEdges;
+    bool badArgs = (argc != 2 && argc != 4);
+    if (argc == 4) {
+        const std::string opt = argv[2];
+        try {
+            if (opt == "--merge")
+                mergeN = std::stoul(argv[3]);
+            else if (opt == "--merge-edges")
+                for (const auto& e : Utility::split(argv[3], ','))
+                    mergeEdges.push_back(std::stod(e));
+            else
+                badArgs = true;
+        } catch (const std::exception&) {
+            badArgs = true;
+        }
+    }
+    if (badArgs) {
+        std::cerr << "Usage: " << argv[0] << " <projectDir> [--merge N | --merge-edges e0,e1,...]\n";
         return 1;
     }
 
@@ -25,8 +48,12 @@ int main(int argc, char** argv) {
 
     // Where all YAML will go
     const std::string outPath = "out/" + projectDir + "/asymmetry_results.yaml";
+    const std::string mergedPath = "out/" + projectDir + "/asymmetry_merged_results.yaml";
+    const std::string injectionPath = "out/" + projectDir + "/injection_summary.yaml";
 
-    bool append = false; // first dump truncates; subsequent dumps append
+    bool append = false;          // first dump truncates; subsequent dumps append
+    bool mergedAppend = false;    // same, counted over the pairs/runs that were merged
+    bool injectionAppend = false; // same, counted over the pairs/runs with injection studies
 
     for (const auto& pair : pionPairs) {
         for (const auto& runVersion : runVersions) {
@@ -47,7 +74,10 @@ int main(int argc, char** argv) {
 
             // Region logic
             const bool hasPi0 = (pair.find("pi0") != std::string::npos);
-            std::string regionName = hasPi0 ? Constants::DEFAULT_PI0_SIGNAL_REGION : "signal";
+            std::string regionName = "signal";
+            if (hasPi0) // purityBinning method splot leaves one sWeighted region instead of purity cells
+                regionName = asym.hasRegion(Constants::SPLOT_PI0_SIGNAL_REGION) ? Constants::SPLOT_PI0_SIGNAL_REGION
+                                                                                : Constants::DEFAULT_PI0_SIGNAL_REGION;
             std::string regionType = hasPi0 ? "signal" : "full";
 
             // Loop over pw = 0..11
@@ -57,6 +87,28 @@ int main(int argc, char** argv) {
 
             // Dump/append YAML
             asym.dumpYaml(outPath, append);
+
+            // Merged bins, solved from the summed moment sidecars
+            if (mergeN > 0 || mergeEdges.size() > 1) {
+                BinMerger merger(projectDir, pair, runVersion, synth.getResults(), synth.getConfigsMap());
+                if (!merger.missing().empty()) {
+                    // a merge that silently drops bins is not the requested binning
+                    LOG_ERROR("Not merging pair=" << pair << ", run=" << runVersion << ": " << merger.missing().size()
+                                                  << " configs have no moment sidecar. Only the native engine writes it;"
+                                                  << " rerun asymmetryPW without engine=roofit.");
+                } else {
+                    if (mergeN > 0)
+                        merger.mergeConsecutive(mergeN);
+                    else
+                        merger.mergeByEdges(mergeEdges);
+                    merger.dumpYaml(mergedPath, mergedAppend);
+                    mergedAppend = true;
+                }
+            }
+            // Injection-closure statistics, if the injection module ran
+            InjectionSummary injection(pair, runVersion, synth.getResults(), synth.getConfigsMap());
+            if (injection.dumpYaml(injectionPath, injectionAppend))
+                injectionAppend = true;
             append = true;
         }
     }
@@ -0,0 +1,155 @@
+// ────────────────────────────────────────────────────────────
+//  src/modules/yapwrModule.cpp – compiled driver of the modules
+//
+//      yapwr-module <module> [arg ...]
+//
+//  Runs the same function as
+//
+//      root -l -b -q 'src/modules/<module>.C(arg, ...)'
+//
+//  but from libyapwr_modules, so a job no longer pays the interpreter
+//  start-up and the JIT of the macro, RooFit and yaml-cpp headers.
+//  As with cling, the overload is picked by the number of arguments.
+// ----------------------------------------------------------------
+#include <TROOT.h>
+#include <TStopwatch.h>
+
+#include <functional>
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "yapwrModules.h"
+
+namespace {
+
+using Args = std::vector<std::string>;
+using Entry = std::function<void(const Args&)>;
+
+// module → (number of arguments → call)
+const std::map<std::string, std::map<size_t, Entry>>& entries() {
+    static const std::map<std::string, std::map<size_t, Entry>> table = {
+        {"asymmetry",
+         {{4, [](const Args& a) { asymmetry(a[0].c_str(), a[1].c_str(), a[2].c_str(), a[3].c_str()); }},
+          {5, [](const Args& a) { asymmetry(a[0].c_str(), a[1].c_str(), a[2].c_str(), a[3].c_str(), a[4].c_str()); }},
+          {6, [](const Args& a) { asymmetry(a[0].c_str(), a[1].c_str(), a[2].c_str(), a[3].c_str(), a[4].c_str(), a[5].c_str()); }},
+          {7, [](const Args& a) {
+               asymmetry(a[0].c_str(), a[1].c_str(), a[2].c_str(), a[3].c_str(), a[4].c_str(), a[5].c_str(), a[6].c_str());
+           }}}},
+        {"injectAsymmetry",
+         {{4, [](const Args& a) { injectAsymmetry(a[0].c_str(), a[1].c_str(), a[2].c_str(), a[3].c_str()); }},
+          {5, [](const Args& a) { injectAsymmetry(a[0].c_str(), a[1].c_str(), a[2].c_str(), a[3].c_str(), a[4].c_str(), 0); }},
+          {6,
+           [](const Args& a) {
+               injectAsymmetry(a[0].c_str(), a[1].c_str(), a[2].c_str(), a[3].c_str(), a[4].c_str(), std::stoi(a[5]));
+           }},
+          {7,
+           [](const Args& a) {
+               injectAsymmetry(a[0].c_str(), a[1].c_str(), a[2].c_str(), a[3].c_str(), a[4].c_str(), std::stoi(a[5]), a[6].c_str());
+           }},
+          {8,
+           [](const Args& a) {
+               injectAsymmetry(a[0].c_str(), a[1].c_str(), a[2].c_str(), a[3].c_str(), a[4].c_str(), std::stoi(a[5]), a[6].c_str(),
+                               std::stoi(a[7]));
+           }},
+          {9, [](const Args& a) {
+               injectAsymmetry(a[0].c_str(), a[1].c_str(), a[2].c_str(), a[3].c_str(), a[4].c_str(), std::stoi(a[5]), a[6].c_str(),
+                               std::stoi(a[7]), std::stol(a[8]));
+           }}}},
+        {"baryonContamination",
+         {{4, [](const Args& a) { baryonContamination(a[0].c_str(), a[1].c_str(), a[2].c_str(), a[3].c_str()); }}}},
+        {"binMigration",
+         {{5, [](const Args& a) { binMigration(a[0].c_str(), a[1].c_str(), a[2].c_str(), a[3].c_str(), a[4].c_str()); }}}},
+        {"filterTree",
+         {{5, [](const Args& a) { filterTree(a[0].c_str(), a[1].c_str(), a[2].c_str(), a[3].c_str(), a[4].c_str(), -1); }},
+          {6,
+           [](const Args& a) {
+               filterTree(a[0].c_str(), a[1].c_str(), a[2].c_str(), a[3].c_str(), a[4].c_str(), std::stoi(a[5]));
+           }}}},
+        {"filterTreeMC",
+         {{5, [](const Args& a) { filterTreeMC(a[0].c_str(), a[1].c_str(), a[2].c_str(), a[3].c_str(), a[4].c_str(), -1); }},
+          {6,
+           [](const Args& a) {
+               filterTreeMC(a[0].c_str(), a[1].c_str(), a[2].c_str(), a[3].c_str(), a[4].c_str(), std::stoi(a[5]));
+           }}}},
+        {"kinematicBins",
+         {{5, [](const Args& a) { kinematicBins(a[0].c_str(), a[1].c_str(), a[2].c_str(), a[3].c_str(), a[4].c_str()); }}}},
+        {"particleMisidentification",
+         {{4, [](const Args& a) { particleMisidentification(a[0].c_str(), a[1].c_str(), a[2].c_str(), a[3].c_str()); }}}},
+        {"purityBinning",
+         {{4, [](const Args& a) { purityBinning(a[0].c_str(), a[1].c_str(), a[2].c_str(), a[3].c_str()); }},
+          {5, [](const Args& a) { purityBinning(a[0].c_str(), a[1].c_str(), a[2].c_str(), a[3].c_str(), std::stoi(a[4])); }},
+          {6,
+           [](const Args& a) {
+               purityBinning(a[0].c_str(), a[1].c_str(), a[2].c_str(), a[3].c_str(), std::stoi(a[4]), a[5].c_str());
+           }},
+          {7,
+           [](const Args& a) {
+               purityBinning(a[0].c_str(), a[1].c_str(), a[2].c_str(), a[3].c_str(), std::stoi(a[4]), a[5].c_str(),
+                             a[6].c_str());
+           }}}},
+        {"benchmarkKernels",
+         {{0, [](const Args&) { benchmarkKernels(2000000, 5, 1); }},
+          {1, [](const Args& a) { benchmarkKernels(std::stol(a[0]), 5, 1); }},
+          {2, [](const Args& a) { benchmarkKernels(std::stol(a[0]), std::stoi(a[1]), 1); }},
+          {3, [](const Args& a) { benchmarkKernels(std::stol(a[0]), std::stoi(a[1]), std::stoi(a[2])); }}}},
+    };
+    return table;
+}
+
+void usage(const char* prog) {
+    std::cerr << "Usage: " << prog << " <module> [arg ...]\n  modules (argument counts):\n";
+    for (const auto& [name, overloads] : entries()) {
+        std::cerr << "    " << name << " (";
+        const char* sep = "";
+        for (const auto& kv : overloads) {
+            std::cerr << sep << kv.first;
+            sep = ", ";
+        }
+        std::cerr << ")\n";
+    }
+}
+
+} // anonymous namespace
+
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    // accept "asymmetry", "asymmetry.C" and "src/modules/asymmetry.C"
+    std::string name = argv[1];
+    name = name.substr(name.find_last_of('/') + 1);
+    if (name.size() > 2 && name.compare(name.size() - 2, 2, ".C") == 0)
+        name.resize(name.size() - 2);
+
+    auto module = entries().find(name);
+    if (module == entries().end()) {
+        std::cerr << "[yapwr-module] unknown module '" << name << "'\n";
+        usage(argv[0]);
+        return 1;
+    }
+
+    const Args args(argv + 2, argv + argc);
+    auto call = module->second.find(args.size());
+    if (call == module->second.end()) {
+        std::cerr << "[yapwr-module] " << name << " takes no overload with " << args.size() << " arguments\n";
+        usage(argv[0]);
+        return 1;
+    }
+
+    gROOT->SetBatch(true); // as `root -b`: canvases are only written to file
+    TStopwatch sw;
+    sw.Start();
+    try {
+        call->second(args);
+    } catch (const std::exception& e) {
+        std::cerr << "[yapwr-module] " << name << ": " << e.what() << "\n";
+        return 1;
+    }
+    sw.Stop();
+    std::cout << "[yapwr-module] " << name << " done in " << sw.RealTime() << " s wall, " << sw.CpuTime() << " s CPU\n";
+    return 0;
+}
@@ -0,0 +1,41 @@
+// ────────────────────────────────────────────────────────────
+//  src/modules/yapwrModules.h – entry points of libyapwr_modules
+//
+//  The same functions the Ruby runners call as ROOT macros, compiled
+//  once by CMake.  Signatures must stay in step with the .C files;
+//  default arguments live in the macros and are filled in by the
+//  dispatcher (yapwrModule.cpp).
+// ----------------------------------------------------------------
+#pragma once
+
+void asymmetry(const char* input, const char* tree, const char* pair, const char* outDir);
+void asymmetry(const char* input, const char* tree, const char* pair, const char* outDir, const char* fitOptions);
+void asymmetry(const char* input, const char* tree, const char* pair, const char* outDir, const char* signalRegion,
+               const char* backgroundRegion);
+void asymmetry(const char* input, const char* tree, const char* pair, const char* outDir, const char* signalRegion,
+               const char* backgroundRegion, const char* fitOptions);
+
+void injectAsymmetry(const char* input, const char* tree, const char* pair, const char* outDir);
+void injectAsymmetry(const char* input, const char* tree, const char* pair, const char* outDir, const char* yamlPath, const int trial);
+void injectAsymmetry(const char* input, const char* tree, const char* pair, const char* outDir, const char* yamlPath, const int trial,
+                     const char* fitOptions);
+void injectAsymmetry(const char* input, const char* tree, const char* pair, const char* outDir, const char* yamlPath, const int trial,
+                     const char* fitOptions, const int nTrials);
+void injectAsymmetry(const char* input, const char* tree, const char* pair, const char* outDir, const char* yamlPath, const int trial,
+                     const char* fitOptions, const int nTrials, const long seed);
+
+void baryonContamination(const char* filePath, const char* treeName, const char* cutYamlPath, const char* outYamlPath);
+void binMigration(const char* filePath, const char* treeName, const char* primaryYaml, const char* projectDir, const char* yamlPath);
+void filterTree(const char* inputPath, const char* treeName, const char* configPath, const char* pairName, const char* outputDir,
+                int maxEntries);
+void filterTreeMC(const char* inputPath, const char* treeName, const char* configPath, const char* pairName, const char* outputDir,
+                  int maxEntries);
+void kinematicBins(const char* file, const char* treeName, const char* pair, const char* cutYamlPath, const char* outDir);
+void particleMisidentification(const char* filePath, const char* treeName, const char* cutYamlPath, const char* yamlPath);
+void purityBinning(const char* inputPath, const char* treeName, const char* pairName, const char* outputDir);
+void purityBinning(const char* inputPath, const char* treeName, const char* pairName, const char* outputDir, int nThreads);
+void purityBinning(const char* inputPath, const char* treeName, const char* pairName, const char* outputDir, int nThreads,
+                   const char* method);
+void purityBinning(const char* inputPath, const char* treeName, const char* pairName, const char* outputDir, int nThreads,
+                   const char* method, const char* gridYaml);
+void benchmarkKernels(long nEvents, int nRepeat, int threads);
@@ -225,6 +225,7 @@ def fetchAxInjection(
           - true_vals: 1D array (length M)
           - true_errs: 1D array (length M)
           (used for the SEM band fill and the point/line draw)
+          - asimov: 1D array (length M) or None, drawn as a line
     """
     if ax is None:
         fig, ax = plt.subplots()
@@ -237,12 +238,9 @@ def fetchAxInjection(
     for data,spec in zip(data_list,series_specs):
         # 1) collect complete trials
         complete = [s for s in data.trials.values() if not np.isnan(s).any()]
-        if not complete:
+        if not complete and data.asimov is None:
             raise RuntimeError("No complete trial series found")
-        trial_mat = np.vstack(complete)      # shape (T, M)
-        mu   = trial_mat.mean(axis=0)        # length M
-        sig  = trial_mat.std(axis=0, ddof=1) # length M
-        N    = trial_mat.shape[0]
+        N    = len(complete)
 
         pair = data.pion_pair
         mstyle = spec.get('markerstyle', PAIR_MARKER[pair])
@@ -254,13 +252,21 @@ def fetchAxInjection(
         label  = spec.get('label', PAIR_LABEL[pair])
         
         # 2) SEM band
-        sem = sig / np.sqrt(N)
         x = data.x_vals
-        ax.fill_between(
-            x, mu - sem, mu + sem,
-            color=lcolor, alpha=0.3,
-            label=f"{label} ($\mu_{{\mathrm{{inj}}}}\pm\Delta\mu$)", zorder=0
-        )
+        if N > 1:
+            trial_mat = np.vstack(complete)      # shape (T, M)
+            mu   = trial_mat.mean(axis=0)        # length M
+            sig  = trial_mat.std(axis=0, ddof=1) # length M
+            sem = sig / np.sqrt(N)
+            ax.fill_between(
+                x, mu - sem, mu + sem,
+                color=lcolor, alpha=0.3,
+                label=f"{label} ($\mu_{{\mathrm{{inj}}}}\pm\Delta\mu$)", zorder=0
+            )
+        # expected extraction, no sampling noise
+        if data.asimov is not None:
+            ax.plot(x, data.asimov, color=lcolor, lw=1.0,
+                    label=f"{label} (Asimov)", zorder=0)
 
         # 3) injected true values
         eb_kwargs = dict(
@@ -289,7 +295,7 @@ def fetchAxInjection(
     uniq = OrderedDict(zip(labels, handles))
     ax.legend(uniq.values(), uniq.keys(), frameon=True,fontsize=6)
     ax.set_ylabel(f"$A_{{\\mathrm{{LU,\mathrm{{tw.{data.twist_}}}}}}}^{{|{data.L_},{data.M_}\\rangle}}$", fontsize=12)
-    ax.set_title(f"{N} Injection Trials")
+    ax.set_title(f"{N} Injection Trials" if N else "Asimov Injection")
     return ax
     
 def plotSysFig(yamlData,
@@ -91,18 +91,24 @@ class InjectionData:
     twist_:       int
     trials:       dict[int, np.ndarray]         # trial_id -> length M
     config_paths: tuple                         # original config roots
+    asimov:       np.ndarray = None             # length M, expected (asimov=1) fit; NaN where missing
 
 def injection_dataloader(
         *,
         project_dir,
         pion_pair,
         run_version,
-        region   = 'signal_purity_1_1',
+        region   = None,
         b_index  = 0
 ) -> InjectionData:
     """
     Collect "true" and injected b_k values across *all* configs.
 
+    region=None takes the signal region each leaf has: signal_splot
+    (purityBinning method splot), else signal_purity_1_1, else signal.
+    Injection fits the MC purity grids, never sWeights, so the injected
+    values of a signal_splot leaf are read from signal_purity_1_1.
+
     Directory pattern searched:
         out/<project_dir>/*/<pion_pair>/<run_version>/
 
@@ -124,7 +130,14 @@ def injection_dataloader(
     true_vals = np.empty(M, dtype=float)
     true_errs = np.empty(M, dtype=float)
     trials: dict[int, list] = {}          # trial_id -> list of length M
+    asimov    = np.full(M, np.nan)
     asymmetryYamlData = loadFromYamlPath("../out/"+project_dir+"/asymmetry_results.yaml")
+    # injection trials summarised by the synthesizer (InjectionSummary), if present
+    summary = {}
+    summary_path = os.path.join('../out', project_dir, 'injection_summary.yaml')
+    if os.path.exists(summary_path):
+        summary = {rec['config']: rec for rec in loadFromYamlPath(summary_path)
+                   if rec.get('pionPair') == pion_pair and rec.get('runVersion') == run_version}
     for m, true_yaml in enumerate(true_paths):
         cfg_name = os.path.basename(
                    os.path.dirname(
@@ -143,15 +156,35 @@ def injection_dataloader(
         # ---- read true value -------------------------------------
         with open(true_yaml, 'r') as f:
             data = yaml.safe_load(f)
+        leaf_regions = [e['region'] for e in data['results']]
+        leaf_region  = region or next((r for r in ('signal_splot', 'signal_purity_1_1')
+                                       if r in leaf_regions), 'signal')
         entry = next(e for e in data['results']
-                     if e['region'] == region)
+                     if e['region'] == leaf_region)
+        inj_name = 'signal_purity_1_1' if leaf_region == 'signal_splot' else leaf_region
         key   = f'b_{b_index}'
         x_vals[m]    = get_bin_center_from_cfg(true_yaml)
         true_vals[m] = x["A_raw"]
         true_errs[m] = np.sqrt(x["sStat"]**2+x["sSys"]**2)
         # ---- read injections -------------------------------------
+        inj_region = summary.get(cfg_name, {}).get('regions', {}).get(inj_name)
+        if inj_region is not None:
+            term = inj_region.get(f'b_{b_index}', {})
+            for tidx, val in zip(inj_region['trials'], term.get('values', [])):
+                trials.setdefault(tidx, [np.nan]*M)
+                trials[tidx][m] = float(val)
+            asimov[m] = term.get('asimov', np.nan)
+            continue
         cfg_root = os.path.dirname(os.path.dirname(true_yaml))
         inj_dir  = os.path.join(cfg_root, 'module-out___asymmetryInjectionPW')
+        asimov_yaml = os.path.join(inj_dir, 'asymmetryInjection_asimov.yaml')
+        if os.path.exists(asimov_yaml):
+            with open(asimov_yaml, 'r') as f:
+                inj = yaml.safe_load(f)
+            inj_entry = next((e for e in inj['results']
+                              if e['region'] == inj_name), None)
+            if inj_entry and f'b_{b_index}' in inj_entry:
+                asimov[m] = float(inj_entry[f'b_{b_index}'])
         for fpath in sorted(glob.glob(os.path.join(inj_dir, '*.yaml')), key=sort_cfgB):
             tidx = _trial_index(os.path.basename(fpath))
             if tidx is None:
@@ -159,7 +192,7 @@ def injection_dataloader(
             with open(fpath, 'r') as f:
                 inj = yaml.safe_load(f)
             inj_entry = next((e for e in inj['results']
-                              if e['region'] == region), None)
+                              if e['region'] == inj_name), None)
             if not inj_entry or f'b_{b_index}' not in inj_entry:
                 continue
             trials.setdefault(tidx, [np.nan]*M)
@@ -176,5 +209,6 @@ def injection_dataloader(
         M_           = M_,
         twist_       = twist,
         trials       = trials,
-        config_paths = tuple(os.path.dirname(os.path.dirname(p)) for p in true_paths)
+        config_paths = tuple(os.path.dirname(os.path.dirname(p)) for p in true_paths),
+        asimov       = asimov if not np.isnan(asimov).all() else None
     )
\ No newline at end of file
@@ -46,7 +46,10 @@ Result AsymmetryProcessor::loadData(const std::filesystem::path& dir) const {
                 if (key == "region" || key == "entries" || key == "fit_failed")
                     continue;
 
-                double value = kv.second.as<double>();
+                // bookkeeping such as start_from / start is not a scalar result
+                double value;
+                if (!kv.second.IsScalar() || !YAML::convert<double>::decode(kv.second, value))
+                    continue;
                 std::string scalarName = region + "." + key;
                 r.scalars[scalarName] = value;
             }
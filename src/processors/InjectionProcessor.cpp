@@ -0,0 +1,181 @@
+#include "InjectionProcessor.h"
+#include "Constants.h"
+#include "ModuleProcessorFactory.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <iomanip>
+#include <regex>
+#include <sstream>
+#include <thread>
+#include <yaml-cpp/yaml.h>
+
+namespace fs = std::filesystem;
+
+namespace {
+std::unique_ptr<ModuleProcessor> make() {
+    return std::make_unique<InjectionProcessor>();
+}
+const bool registered = []() {
+    ModuleProcessorFactory::instance().registerProcessor("asymmetryInjectionPW", make);
+    return true;
+}();
+} // namespace
+
+InjectionProcessor::TrialFit InjectionProcessor::readTrial(const fs::path& yamlPath) {
+    TrialFit fit;
+    try {
+        YAML::Node doc = YAML::LoadFile(yamlPath.string());
+        for (const auto& node : doc["results"]) {
+            if (auto ff = node["fit_failed"]; ff && ff.as<bool>())
+                continue;
+            auto& region = fit[node["region"].as<std::string>()];
+            for (int i = 0; i < 12; ++i) {
+                const std::string key = "b_" + std::to_string(i);
+                if (node[key] && node[key + "_err"])
+                    region[key] = {node[key].as<double>(), node[key + "_err"].as<double>()};
+            }
+        }
+    } catch (const YAML::Exception& e) {
+        LOG_WARN("Failed to load YAML '" + yamlPath.string() + "': " + e.what());
+        fit.clear();
+    }
+    return fit;
+}
+
+bool InjectionProcessor::readInjected(const fs::path& leafDir, bool pi0, std::vector<double>& sig, std::vector<double>& bkg) {
+    // defaults and lookup of loadAsymmetriesFromYaml() in injectAsymmetry.C
+    sig.assign(12, 0.1);
+    bkg.assign(12, 0.0);
+    fs::path yamlPath = leafDir / "module-out___asymmetryPW" / "asymmetry_results.yaml";
+    if (!fs::exists(yamlPath))
+        yamlPath = leafDir / "module-out___asymmetryPW" / "asymmetryPW.yaml";
+    try {
+        YAML::Node doc = YAML::LoadFile(yamlPath.string());
+        // π0: the data sPlot region if there is one, else the first purity cell; the trials
+        // themselves are signal_purity_* fits on the MC grids
+        std::string wantSig = "signal";
+        if (pi0) {
+            wantSig = Constants::DEFAULT_PI0_SIGNAL_REGION;
+            for (const auto& node : doc["results"])
+                if (node["region"].as<std::string>() == Constants::SPLOT_PI0_SIGNAL_REGION)
+                    wantSig = Constants::SPLOT_PI0_SIGNAL_REGION;
+        }
+        bool found = false;
+        for (const auto& node : doc["results"]) {
+            const std::string region = node["region"].as<std::string>();
+            found = found || region == wantSig;
+            std::vector<double>* amp = region == "background" ? &bkg : region == wantSig ? &sig : nullptr;
+            for (int i = 0; amp && i < 12; ++i)
+                if (auto v = node["b_" + std::to_string(i)])
+                    (*amp)[i] = v.as<double>();
+        }
+        if (!found) {
+            LOG_WARN("No injected amplitudes from '" + yamlPath.string() + "': no region " + wantSig);
+            return false;
+        }
+    } catch (const YAML::Exception& e) {
+        LOG_WARN("No injected amplitudes from '" + yamlPath.string() + "': " + e.what());
+        return false;
+    }
+    return true;
+}
+
+Result InjectionProcessor::process(const std::string& moduleOutDir, const Config& cfg) {
+    Result r;
+    r.moduleName = name();
+    const fs::path dir = effectiveOutDir(moduleOutDir, cfg);
+    if (!fs::is_directory(dir)) {
+        LOG_WARN("No injection output in " + dir.string());
+        return r;
+    }
+
+    // trial files, in trial order
+    static const std::regex trialRe("asymmetryInjection_results_(\\d+)\\.yaml");
+    std::vector<std::pair<int, fs::path>> files;
+    for (const auto& entry : fs::directory_iterator(dir)) {
+        std::smatch m;
+        const std::string fname = entry.path().filename().string();
+        if (std::regex_match(fname, m, trialRe))
+            files.emplace_back(std::stoi(m[1]), entry.path());
+    }
+    std::sort(files.begin(), files.end());
+
+    // one YAML per task; the files are independent, so read them on all cores
+    std::vector<TrialFit> fits(files.size());
+    std::atomic<size_t> next{0};
+    auto work = [&] {
+        for (size_t k; (k = next.fetch_add(1)) < files.size();)
+            fits[k] = readTrial(files[k].second);
+    };
+    const size_t nThreads = std::min<size_t>(std::max(1u, std::thread::hardware_concurrency()), files.size());
+    std::vector<std::thread> pool;
+    for (size_t t = 1; t < nThreads; ++t)
+        pool.emplace_back(work);
+    work();
+    for (auto& t : pool)
+        t.join();
+    LOG_INFO("Read " << files.size() << " injection trials from " << dir.string());
+
+    std::vector<double> sig, bkg;
+    // without them injectAsymmetry.C refused to run; the trials, if any, predate the amplitudes
+    const bool haveInjected = readInjected(dir.parent_path(), cfg.contains_pi0(), sig, bkg);
+    const TrialFit asimov = fs::exists(dir / "asymmetryInjection_asimov.yaml") ? readTrial(dir / "asymmetryInjection_asimov.yaml")
+                                                                               : TrialFit{};
+
+    // regions seen in any trial
+    std::map<std::string, std::vector<size_t>> regions; // region → trials that fitted it
+    for (size_t k = 0; k < fits.size(); ++k)
+        for (const auto& [region, terms] : fits[k])
+            regions[region].push_back(k);
+
+    for (const auto& [region, trials] : regions) {
+        const std::vector<double>& inj = region == "background" ? bkg : sig;
+        r.scalars[region + ".trials"] = trials.size();
+        for (int i = 0; i < 12; ++i) {
+            const std::string key = "b_" + std::to_string(i);
+            double n = 0, sum = 0, sum2 = 0, sumErr = 0, nPull = 0, pull = 0, pull2 = 0;
+            for (size_t k : trials) {
+                auto it = fits[k].at(region).find(key);
+                if (it == fits[k].at(region).end())
+                    continue;
+                const auto [val, err] = it->second;
+                std::ostringstream trialKey;
+                trialKey << region << ".trial_" << std::setw(4) << std::setfill('0') << files[k].first << "." << key;
+                r.scalars[trialKey.str()] = val;
+                n += 1;
+                sum += val;
+                sum2 += val * val;
+                sumErr += err;
+                if (err > 0) { // a trial without an error has no pull, but must not void the others
+                    const double p = (val - inj[i]) / err;
+                    nPull += 1;
+                    pull += p;
+                    pull2 += p * p;
+                }
+            }
+            if (n == 0)
+                continue;
+            const std::string pre = region + "." + key;
+            const double mean = sum / n, pullMean = nPull > 0 ? pull / nPull : NAN;
+            r.scalars[pre + "_mean"] = mean;
+            r.scalars[pre + "_rms"] = n > 1 ? std::sqrt(std::max(0.0, (sum2 - n * mean * mean) / (n - 1))) : NAN;
+            r.scalars[pre + "_err_mean"] = sumErr / n;
+            if (!haveInjected)
+                continue;
+            r.scalars[pre + "_inj"] = inj[i];
+            r.scalars[pre + "_bias"] = mean - inj[i];
+            r.scalars[pre + "_pull_mean"] = pullMean;
+            r.scalars[pre + "_pull_rms"] =
+                nPull > 1 ? std::sqrt(std::max(0.0, (pull2 - nPull * pullMean * pullMean) / (nPull - 1))) : NAN;
+        }
+    }
+    for (const auto& [region, terms] : asimov)
+        for (const auto& [key, valErr] : terms) {
+            if (haveInjected)
+                r.scalars[region + "." + key + "_inj"] = (region == "background" ? bkg : sig)[std::stoi(key.substr(2))];
+            r.scalars[region + "." + key + "_asimov"] = valErr.first;
+        }
+    return r;
+}
@@ -0,0 +1,34 @@
+#pragma once
+#include "ModuleProcessor.h"
+#include <filesystem>
+#include <map>
+#include <string>
+#include <vector>
+
+/// Injection-closure study of one leaf (module-out___asymmetryInjectionPW):
+/// reads every asymmetryInjection_results_NNNN.yaml, in parallel, and
+/// reduces the trials per region and term to
+///
+///   <region>.trials                 fitted trials
+///   <region>.b_i_inj                injected amplitude (data fit, as injectAsymmetry.C reads it)
+///   <region>.b_i_mean / _rms        mean and spread of the extracted b_i
+///   <region>.b_i_err_mean           mean fit error
+///   <region>.b_i_bias               mean − injected
+///   <region>.b_i_pull_mean / _rms   (b_i − injected) / b_i_err
+///   <region>.b_i_asimov             Asimov fit, if asymmetryInjection_asimov.yaml exists
+///   <region>.trial_NNNN.b_i         every trial's value (InjectionSummary)
+class InjectionProcessor : public ModuleProcessor {
+public:
+    std::string name() const override {
+        return "asymmetryInjectionPW";
+    }
+    Result process(const std::string& moduleOutDir, const Config& cfg) override;
+
+private:
+    // region → b_i → (value, error); empty if the file could not be read
+    using TrialFit = std::map<std::string, std::map<std::string, std::pair<double, double>>>;
+    static TrialFit readTrial(const std::filesystem::path& yamlPath);
+
+    // amplitudes injected into the signal and background events
+    static bool readInjected(const std::filesystem::path& leafDir, bool pi0, std::vector<double>& sig, std::vector<double>& bkg);
+};